@@ -5,46 +5,178 @@
 #include <sstream>
 #include <glibmm/miscutils.h>
 #include <cstdint>
+#include <ctime>
+#include <algorithm>
 
 #ifndef NO_DISTRACTIONS_DATADIR
 #define NO_DISTRACTIONS_DATADIR .
 #endif
 
+#ifndef NO_DISTRACTIONS_ARCHIVE_DAYS
+#define NO_DISTRACTIONS_ARCHIVE_DAYS 30
+#endif
+
 #define STR_HELPER(x) #x
 #define STR(x) STR_HELPER(x)
 
 namespace {
 const int kCharacterPanelWidth = 240;
 const char* kInstallDataDir = STR(NO_DISTRACTIONS_DATADIR);
+const int kMainTimerId = 0;
+const std::chrono::seconds kPomodoroWork = std::chrono::minutes(25);
+const std::chrono::seconds kPomodoroBreak = std::chrono::minutes(5);
+const char* kStyleResource = "/com/yourname/nodistractions/style.css";
+const char* kLogFile = "work_log.txt";
+const char* kArchiveDir = "work_log_archive";
+const int kArchiveDays = NO_DISTRACTIONS_ARCHIVE_DAYS;
+
+std::string format_duration(std::chrono::seconds duration) {
+    int totalSeconds = static_cast<int>(duration.count());
+    if (totalSeconds < 0) totalSeconds = 0;
+    int hours = totalSeconds / 3600;
+    int minutes = (totalSeconds % 3600) / 60;
+    int seconds = totalSeconds % 60;
+
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d", hours, minutes, seconds);
+    return buffer;
+}
+
+std::string format_timer_text(const WorkTimer& timer, std::chrono::steady_clock::time_point now) {
+    auto elapsed = timer.elapsed(now);
+    switch (timer.phase) {
+        case WorkTimer::Phase::Work:
+            return timer.name + " • Work " + format_duration(timer.phaseLength - elapsed);
+        case WorkTimer::Phase::Break:
+            return timer.name + " • Break " + format_duration(timer.phaseLength - elapsed);
+        case WorkTimer::Phase::Free:
+        default:
+            return timer.name + " • " + format_duration(elapsed);
+    }
+}
+
+// Log record shared by the plain recent log and the compressed archive segments
+std::string format_session(const WorkSession& s) {
+    std::string dateStr = s.dateString;
+    if (dateStr.empty()) {
+        auto now = std::chrono::system_clock::now();
+        auto t = std::chrono::system_clock::to_time_t(now);
+        std::ostringstream oss;
+        oss << std::put_time(std::localtime(&t), "%Y-%m-%d %H:%M:%S");
+        dateStr = oss.str();
+    }
+    std::ostringstream out;
+    out << "Date: " << dateStr << "\n";
+    out << "Session: " << s.name << "\n";
+    out << "Description: " << s.description << "\n";
+    out << "Duration: " << s.getDurationInMinutes() << " minutes\n";
+    out << "----------------------------------------\n";
+    return out.str();
+}
+
+bool parse_session_date(const std::string& dateString, std::time_t& out) {
+    std::tm tm {};
+    std::istringstream iss(dateString);
+    iss >> std::get_time(&tm, "%Y-%m-%d %H:%M:%S");
+    if (iss.fail()) return false;
+    tm.tm_isdst = -1;
+    out = std::mktime(&tm);
+    return out != static_cast<std::time_t>(-1);
+}
+
+// Parses log records from any line source; next_line(line) returns false at end of input.
+template <typename LineReader>
+void read_sessions(LineReader next_line, const std::string& archivePath, std::vector<WorkSession>& out) {
+    WorkSession ws;
+    std::string line;
+    auto flush_session = [&]() {
+        if (!ws.name.empty()) {
+            ws.archivePath = archivePath;
+            out.push_back(ws);
+        }
+        ws = WorkSession{};
+    };
+
+    while (next_line(line)) {
+        if (line.rfind("Date:", 0) == 0) {
+            ws.dateString = line.substr(5);
+            if (!ws.dateString.empty() && ws.dateString[0] == ' ') ws.dateString.erase(0,1);
+        } else if (line.rfind("Session:", 0) == 0) {
+            ws.name = line.substr(8);
+            if (!ws.name.empty() && ws.name[0] == ' ') ws.name.erase(0,1);
+        } else if (line.rfind("Description:", 0) == 0) {
+            ws.description = line.substr(12);
+            if (!ws.description.empty() && ws.description[0] == ' ') ws.description.erase(0,1);
+        } else if (line.rfind("Duration:", 0) == 0) {
+            std::string rest = line.substr(9);
+            if (!rest.empty() && rest[0] == ' ') rest.erase(0,1);
+            auto pos = rest.find(" ");
+            if (pos != std::string::npos) rest = rest.substr(0, pos);
+            try {
+                ws.durationMinutes = std::stod(rest);
+            } catch (...) {
+                ws.durationMinutes = 0.0;
+            }
+        } else if (line.find("---") != std::string::npos) {
+            flush_session();
+        }
+    }
+    flush_session();
+}
 }
 
 MainWindow::MainWindow()
-    : m_isRunning(false),
-    m_accumulatedTime(std::chrono::seconds{0}) {
+    : m_editBox(nullptr),
+    m_editName(nullptr),
+    m_editDesc(nullptr),
+    m_editDuration(nullptr),
+    m_updateButton(nullptr),
+    m_deleteButton(nullptr),
+    m_nextTimerId(kMainTimerId + 1),
+    m_archivesLoaded(false) {
     set_title("nodistactions");
     set_default_size(760, 420);
 
+    WorkTimer& mainTimer = m_timers[kMainTimerId];
+    mainTimer.id = kMainTimerId;
+    mainTimer.label = &m_timerLabel;
+
     setup_css();
     setup_ui();
     load_characters();
     load_sessions_from_file();
+    m_archiveButton.set_sensitive(Glib::file_test(kArchiveDir, Glib::FILE_TEST_IS_DIR));
     refresh_sessions_list();
     update_running_state(false);
 
     show_all_children();
+
+    // Archiving compresses and rewrites files; the default idle priority runs it after the first redraw
+    Glib::signal_idle().connect_once(sigc::mem_fun(*this, &MainWindow::on_startup_idle));
+}
+
+void MainWindow::on_startup_idle() {
+    auto before = m_sessions.size();
+    archive_old_sessions();
+    m_archiveButton.set_sensitive(Glib::file_test(kArchiveDir, Glib::FILE_TEST_IS_DIR));
+    if (m_sessions.size() != before) {
+        refresh_sessions_list();
+    }
 }
 
 MainWindow::~MainWindow() {}
 
 void MainWindow::setup_css() {
+    // The theme is compiled into the binary (nodistractions.gresource.xml); setting
+    // NODISTRACTIONS_CSS to a stylesheet path loads that file instead.
     auto cssProvider = Gtk::CssProvider::create();
-    auto cssPath = find_asset_path("style.css");
-    if (cssPath.empty()) {
-        std::cerr << "Could not find style.css; continuing with default theme." << std::endl;
-        return;
-    }
+    auto cssOverride = Glib::getenv("NODISTRACTIONS_CSS");
     try {
-        cssProvider->load_from_path(cssPath);
+        if (cssOverride.empty()) {
+            cssProvider->load_from_resource(kStyleResource);
+        } else {
+            cssProvider->load_from_path(cssOverride);
+        }
         Gtk::StyleContext::add_provider_for_screen(
             Gdk::Screen::get_default(),
             cssProvider,
@@ -152,6 +284,26 @@ void MainWindow::setup_ui() {
     m_saveButton.signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_save_clicked));
     m_resetButton.signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_reset_clicked));
 
+    // Additional timers: extra stopwatches and Pomodoro cycles, listed below the main controls
+    m_timerButtonBox.set_orientation(Gtk::ORIENTATION_HORIZONTAL);
+    m_timerButtonBox.set_spacing(10);
+    m_timerButtonBox.set_halign(Gtk::ALIGN_CENTER);
+    m_timerNameEntry.set_placeholder_text("Task Name");
+    m_timerButtonBox.pack_start(m_timerNameEntry, Gtk::PACK_SHRINK);
+    m_addTimerButton.set_label("+ Timer");
+    m_addPomodoroButton.set_label("+ Pomodoro");
+    m_timerButtonBox.pack_start(m_addTimerButton, Gtk::PACK_SHRINK);
+    m_timerButtonBox.pack_start(m_addPomodoroButton, Gtk::PACK_SHRINK);
+    m_controlsVBox.pack_start(m_timerButtonBox, Gtk::PACK_SHRINK);
+
+    m_timersBox.set_orientation(Gtk::ORIENTATION_VERTICAL);
+    m_timersBox.set_spacing(6);
+    m_timersBox.set_name("timers-box");
+    m_controlsVBox.pack_start(m_timersBox, Gtk::PACK_SHRINK);
+
+    m_addTimerButton.signal_clicked().connect(sigc::bind(sigc::mem_fun(*this, &MainWindow::add_timer), false));
+    m_addPomodoroButton.signal_clicked().connect(sigc::bind(sigc::mem_fun(*this, &MainWindow::add_timer), true));
+
     // Sessions panel
     setup_sessions_panel();
     // Place sessions panel on the right, similar styling/width to character panel
@@ -258,34 +410,49 @@ void MainWindow::setup_sessions_panel() {
     m_sessionsList.signal_row_selected().connect(sigc::mem_fun(*this, &MainWindow::on_session_row_selected));
     m_sessionsBox.pack_start(m_sessionsScroll, Gtk::PACK_EXPAND_WIDGET);
 
-    // Edit panel
-    m_editBox.set_orientation(Gtk::ORIENTATION_VERTICAL);
-    m_editBox.set_spacing(6);
+    // Archived history is only decompressed when asked for
+    m_archiveButton.set_label("Show Archive");
+    m_archiveButton.signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_archive_clicked));
+    m_sessionsBox.pack_start(m_archiveButton, Gtk::PACK_SHRINK);
 
-    m_editName.set_placeholder_text("Edit name");
-    m_editDesc.set_placeholder_text("Edit description");
-    m_editDuration.set_text("Duration: -");
+    // The edit panel is not needed until a session is selected; create_edit_panel() builds it then.
 
-    m_editBox.pack_start(m_editName, Gtk::PACK_SHRINK);
-    m_editBox.pack_start(m_editDesc, Gtk::PACK_SHRINK);
-    m_editBox.pack_start(m_editDuration, Gtk::PACK_SHRINK);
+    // Removed packing into controls VBox; now placed in mainHBox (right side)
+}
 
-    m_updateButton.set_label("Update Session");
-    m_updateButton.signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_update_session_clicked));
-    m_editBox.pack_start(m_updateButton, Gtk::PACK_SHRINK);
+void MainWindow::create_edit_panel() {
+    if (m_editBox) return;
 
-    m_deleteButton.set_label("Delete Session");
-    m_editBox.pack_start(m_deleteButton, Gtk::PACK_SHRINK);
-    m_deleteButton.signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_delete_session_clicked));
+    m_editBox = Gtk::manage(new Gtk::Box(Gtk::ORIENTATION_VERTICAL));
+    m_editBox->set_spacing(6);
 
-    m_sessionsBox.pack_start(m_editBox, Gtk::PACK_SHRINK);
+    m_editName = Gtk::manage(new Gtk::Entry());
+    m_editName->set_placeholder_text("Edit name");
+    m_editDesc = Gtk::manage(new Gtk::Entry());
+    m_editDesc->set_placeholder_text("Edit description");
+    m_editDuration = Gtk::manage(new Gtk::Label("Duration: -"));
 
-    // Hide edit controls until a session is selected
-    m_editBox.hide();
-    m_updateButton.set_sensitive(false);
-    m_deleteButton.set_sensitive(false);
+    m_editBox->pack_start(*m_editName, Gtk::PACK_SHRINK);
+    m_editBox->pack_start(*m_editDesc, Gtk::PACK_SHRINK);
+    m_editBox->pack_start(*m_editDuration, Gtk::PACK_SHRINK);
 
-    // Removed packing into controls VBox; now placed in mainHBox (right side)
+    m_updateButton = Gtk::manage(new Gtk::Button("Update Session"));
+    m_updateButton->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_update_session_clicked));
+    m_editBox->pack_start(*m_updateButton, Gtk::PACK_SHRINK);
+
+    m_deleteButton = Gtk::manage(new Gtk::Button("Delete Session"));
+    m_deleteButton->signal_clicked().connect(sigc::mem_fun(*this, &MainWindow::on_delete_session_clicked));
+    m_editBox->pack_start(*m_deleteButton, Gtk::PACK_SHRINK);
+
+    m_sessionsBox.pack_start(*m_editBox, Gtk::PACK_SHRINK);
+}
+
+void MainWindow::hide_edit_panel() {
+    // Nothing to hide if no session has been selected yet
+    if (!m_editBox) return;
+    m_editBox->hide();
+    m_updateButton->set_sensitive(false);
+    m_deleteButton->set_sensitive(false);
 }
 
 void MainWindow::refresh_sessions_list() {
@@ -330,66 +497,163 @@ void MainWindow::refresh_sessions_list() {
     m_sessionsList.show_all_children();
 }
 
-void MainWindow::load_sessions_from_file() {
+void MainWindow::load_sessions_from_file(bool includeArchives) {
     m_sessions.clear();
-    std::ifstream infile("work_log.txt");
-    if (!infile.is_open()) return;
-
-    WorkSession ws;
-    std::string line;
-    auto flush_session = [&]() {
-        if (!ws.name.empty()) {
-            m_sessions.push_back(ws);
-        }
-        ws = WorkSession{};
-    };
-
-    while (std::getline(infile, line)) {
-        if (line.rfind("Date:", 0) == 0) {
-            ws.dateString = line.substr(5);
-            if (!ws.dateString.empty() && ws.dateString[0] == ' ') ws.dateString.erase(0,1);
-        } else if (line.rfind("Session:", 0) == 0) {
-            ws.name = line.substr(8);
-            if (!ws.name.empty() && ws.name[0] == ' ') ws.name.erase(0,1);
-        } else if (line.rfind("Description:", 0) == 0) {
-            ws.description = line.substr(12);
-            if (!ws.description.empty() && ws.description[0] == ' ') ws.description.erase(0,1);
-        } else if (line.rfind("Duration:", 0) == 0) {
-            std::string rest = line.substr(9);
-            if (!rest.empty() && rest[0] == ' ') rest.erase(0,1);
-            auto pos = rest.find(" ");
-            if (pos != std::string::npos) rest = rest.substr(0, pos);
+    m_archivesLoaded = includeArchives;
+
+    // Archived segments are older than anything in the recent log, so they go first
+    if (includeArchives) {
+        for (const auto& path : list_archive_segments()) {
+            // Only take a segment that decodes completely: editing a partially read one would
+            // rewrite it with just the sessions before the damage.
+            std::vector<WorkSession> segmentSessions;
             try {
-                ws.durationMinutes = std::stod(rest);
-            } catch (...) {
-                ws.durationMinutes = 0.0;
+                auto fileStream = Gio::File::create_for_path(path)->read();
+                auto decompressor = Gio::ZlibDecompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_GZIP);
+                auto data = Gio::DataInputStream::create(Gio::ConverterInputStream::create(fileStream, decompressor));
+                read_sessions([&](std::string& line) { return data->read_line(line); }, path, segmentSessions);
+            } catch (const Glib::Error& ex) {
+                std::cerr << "Archive read error (" << path << "), skipping segment: " << ex.what() << std::endl;
+                continue;
             }
-        } else if (line.find("---") != std::string::npos) {
-            flush_session();
+            m_sessions.insert(m_sessions.end(), segmentSessions.begin(), segmentSessions.end());
         }
     }
-    flush_session();
+
+    std::ifstream infile(kLogFile);
+    if (!infile.is_open()) return;
+    read_sessions([&](std::string& line) { return static_cast<bool>(std::getline(infile, line)); },
+                  std::string(), m_sessions);
 }
 
 void MainWindow::write_sessions_to_file() {
-    std::ofstream outfile("work_log.txt", std::ios_base::trunc);
+    std::ofstream outfile(kLogFile, std::ios_base::trunc);
     if (!outfile.is_open()) return;
 
     for (const auto& s : m_sessions) {
-        std::string dateStr = s.dateString;
-        if (dateStr.empty()) {
-            auto now = std::chrono::system_clock::now();
-            auto t = std::chrono::system_clock::to_time_t(now);
-            std::ostringstream oss;
-            oss << std::put_time(std::localtime(&t), "%Y-%m-%d %H:%M:%S");
-            dateStr = oss.str();
+        if (!s.archivePath.empty()) continue;
+        outfile << format_session(s);
+    }
+}
+
+bool MainWindow::write_archive_segment(const std::string& path) {
+    std::string contents;
+    for (const auto& s : m_sessions) {
+        if (s.archivePath == path) contents += format_session(s);
+    }
+
+    auto file = Gio::File::create_for_path(path);
+    if (contents.empty()) {
+        try {
+            file->remove();
+            return true;
+        } catch (const Glib::Error& ex) {
+            std::cerr << "Archive remove error (" << path << "): " << ex.what() << std::endl;
+            return false;
+        }
+    }
+
+    // Write next to the segment and move into place only once the stream closed cleanly,
+    // so a failed write never leaves a truncated segment under the real name.
+    auto tmpFile = Gio::File::create_for_path(path + ".tmp");
+    try {
+        {
+            auto compressor = Gio::ZlibCompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_GZIP, -1);
+            auto out = Gio::ConverterOutputStream::create(tmpFile->replace(), compressor);
+            gsize written = 0;
+            out->write_all(contents, written);
+            out->close();
+        }
+        tmpFile->move(file, Gio::FILE_COPY_OVERWRITE);
+        return true;
+    } catch (const Glib::Error& ex) {
+        std::cerr << "Archive write error (" << path << "): " << ex.what() << std::endl;
+    }
+
+    try {
+        tmpFile->remove();
+    } catch (const Glib::Error&) {
+        // Nothing was created
+    }
+    return false;
+}
+
+void MainWindow::archive_old_sessions() {
+    int days = kArchiveDays;
+    auto envDays = Glib::getenv("NODISTRACTIONS_ARCHIVE_DAYS");
+    if (!envDays.empty()) {
+        try {
+            days = std::stoi(envDays);
+        } catch (...) {
+            std::cerr << "Ignoring invalid NODISTRACTIONS_ARCHIVE_DAYS: " << envDays << std::endl;
+        }
+    }
+    if (days <= 0) return;
+
+    auto now = std::chrono::system_clock::now();
+    auto cutoff = std::chrono::system_clock::to_time_t(now - std::chrono::hours(24 * days));
+
+    std::vector<size_t> oldSessions;
+    for (size_t i = 0; i < m_sessions.size(); ++i) {
+        const auto& s = m_sessions[i];
+        std::time_t when = 0;
+        if (s.archivePath.empty() && parse_session_date(s.dateString, when) && when < cutoff) {
+            oldSessions.push_back(i);
+        }
+    }
+    if (oldSessions.empty()) return;
+
+    if (!Glib::file_test(kArchiveDir, Glib::FILE_TEST_IS_DIR)) {
+        try {
+            Gio::File::create_for_path(kArchiveDir)->make_directory_with_parents();
+        } catch (const Glib::Error& ex) {
+            std::cerr << "Could not create " << kArchiveDir << ": " << ex.what() << std::endl;
+            return;
+        }
+    }
+
+    // Segment names sort chronologically: each run only moves sessions newer than earlier segments
+    auto t = std::chrono::system_clock::to_time_t(now);
+    std::ostringstream name;
+    name << "work_log-" << std::put_time(std::localtime(&t), "%Y%m%d-%H%M%S") << ".txt.gz";
+    auto segment = Glib::build_filename(kArchiveDir, name.str());
+    if (Glib::file_test(segment, Glib::FILE_TEST_EXISTS)) return;
+
+    for (auto i : oldSessions) {
+        m_sessions[i].archivePath = segment;
+    }
+    if (!write_archive_segment(segment)) {
+        // Keep everything in the recent log if the archive could not be written
+        for (auto i : oldSessions) {
+            m_sessions[i].archivePath.clear();
+        }
+        return;
+    }
+    write_sessions_to_file();
+
+    // Without the archive view open, archived sessions leave the list
+    if (!m_archivesLoaded) {
+        m_sessions.erase(std::remove_if(m_sessions.begin(), m_sessions.end(),
+                                        [](const WorkSession& s) { return !s.archivePath.empty(); }),
+                         m_sessions.end());
+    }
+}
+
+std::vector<std::string> MainWindow::list_archive_segments() const {
+    std::vector<std::string> segments;
+    if (!Glib::file_test(kArchiveDir, Glib::FILE_TEST_IS_DIR)) return segments;
+    try {
+        Glib::Dir dir(kArchiveDir);
+        for (const auto& name : dir) {
+            if (name.size() > 3 && name.compare(name.size() - 3, 3, ".gz") == 0) {
+                segments.push_back(Glib::build_filename(kArchiveDir, name));
+            }
         }
-        outfile << "Date: " << dateStr << "\n";
-        outfile << "Session: " << s.name << "\n";
-        outfile << "Description: " << s.description << "\n";
-        outfile << "Duration: " << s.getDurationInMinutes() << " minutes\n";
-        outfile << "----------------------------------------\n";
+    } catch (const Glib::Error& ex) {
+        std::cerr << "Archive listing error: " << ex.what() << std::endl;
     }
+    std::sort(segments.begin(), segments.end());
+    return segments;
 }
 
 std::string MainWindow::find_asset_path(const std::string& filename) const {
@@ -410,27 +674,24 @@ std::string MainWindow::find_asset_path(const std::string& filename) const {
 
 void MainWindow::on_session_row_selected(Gtk::ListBoxRow* row) {
     if (!row) {
-        m_editBox.hide();
-        m_updateButton.set_sensitive(false);
-        m_deleteButton.set_sensitive(false);
+        hide_edit_panel();
         return;
     }
     auto idx = reinterpret_cast<intptr_t>(row->get_data("session-index"));
     if (idx < 0 || static_cast<size_t>(idx) >= m_sessions.size()) {
-        m_editBox.hide();
-        m_updateButton.set_sensitive(false);
-        m_deleteButton.set_sensitive(false);
+        hide_edit_panel();
         return;
     }
+    create_edit_panel();
     const auto& s = m_sessions[static_cast<size_t>(idx)];
-    m_editName.set_text(s.name);
-    m_editDesc.set_text(s.description);
+    m_editName->set_text(s.name);
+    m_editDesc->set_text(s.description);
     std::ostringstream oss;
     oss << "Duration: " << std::fixed << std::setprecision(1) << s.getDurationInMinutes() << " minutes";
-    m_editDuration.set_text(oss.str());
-    m_editBox.show_all();
-    m_updateButton.set_sensitive(true);
-    m_deleteButton.set_sensitive(true);
+    m_editDuration->set_text(oss.str());
+    m_editBox->show_all();
+    m_updateButton->set_sensitive(true);
+    m_deleteButton->set_sensitive(true);
 }
 
 void MainWindow::on_update_session_clicked() {
@@ -440,10 +701,15 @@ void MainWindow::on_update_session_clicked() {
     if (idx < 0 || static_cast<size_t>(idx) >= m_sessions.size()) return;
 
     auto& s = m_sessions[static_cast<size_t>(idx)];
-    s.name = m_editName.get_text();
-    s.description = m_editDesc.get_text();
+    s.name = m_editName->get_text();
+    s.description = m_editDesc->get_text();
 
-    write_sessions_to_file();
+    if (s.archivePath.empty()) {
+        write_sessions_to_file();
+    } else if (!write_archive_segment(s.archivePath)) {
+        reload_after_archive_error("Could not update archived session");
+        return;
+    }
     refresh_sessions_list();
     // Reselect updated row
     auto newRow = m_sessionsList.get_row_at_index(static_cast<int>(idx));
@@ -456,22 +722,43 @@ void MainWindow::on_delete_session_clicked() {
     auto idx = reinterpret_cast<intptr_t>(row->get_data("session-index"));
     if (idx < 0 || static_cast<size_t>(idx) >= m_sessions.size()) return;
 
+    std::string archivePath = m_sessions[static_cast<size_t>(idx)].archivePath;
     m_sessions.erase(m_sessions.begin() + static_cast<size_t>(idx));
-    write_sessions_to_file();
+    if (archivePath.empty()) {
+        write_sessions_to_file();
+    } else if (!write_archive_segment(archivePath)) {
+        reload_after_archive_error("Could not delete archived session");
+        return;
+    }
+    refresh_sessions_list();
+    m_editName->set_text("");
+    m_editDesc->set_text("");
+    m_editDuration->set_text("Duration: -");
+    hide_edit_panel();
+}
+
+void MainWindow::reload_after_archive_error(const std::string& message) {
+    // The segment on disk is unchanged; reload so the list shows what is actually stored
+    load_sessions_from_file(m_archivesLoaded);
     refresh_sessions_list();
-    m_editName.set_text("");
-    m_editDesc.set_text("");
-    m_editDuration.set_text("Duration: -");
-    m_editBox.hide();
-    m_updateButton.set_sensitive(false);
-    m_deleteButton.set_sensitive(false);
+    hide_edit_panel();
+
+    auto statusCtx = m_statusLabel.get_style_context();
+    statusCtx->remove_class("saved");
+    m_statusLabel.set_text(message);
+}
+
+void MainWindow::on_archive_clicked() {
+    load_sessions_from_file(!m_archivesLoaded);
+    refresh_sessions_list();
+    m_archiveButton.set_label(m_archivesLoaded ? "Hide Archive" : "Show Archive");
 }
 
 void MainWindow::on_reset_clicked() {
-    if (m_isRunning) {
+    if (main_timer().running) {
         on_stop_clicked();
     }
-    m_accumulatedTime = std::chrono::seconds{0};
+    main_timer().accumulated = std::chrono::seconds{0};
     m_timerLabel.set_text("00:00:00");
     update_running_state(false);
     m_statusLabel.set_text("Ready");
@@ -494,7 +781,7 @@ void MainWindow::update_running_state(bool running) {
         statusCtx->remove_class("running");
         m_spinner.stop();
 
-        if (m_accumulatedTime.count() > 0) {
+        if (main_timer().accumulated.count() > 0) {
             statusCtx->add_class("paused");
             statusCtx->remove_class("saved");
             m_statusLabel.set_text("Paused");
@@ -505,7 +792,7 @@ void MainWindow::update_running_state(bool running) {
         }
     }
 
-    bool hasTime = m_accumulatedTime.count() > 0;
+    bool hasTime = main_timer().accumulated.count() > 0;
     m_startButton.set_sensitive(!running);
     m_stopButton.set_sensitive(running);
     m_saveButton.set_sensitive(running || hasTime);
@@ -513,46 +800,53 @@ void MainWindow::update_running_state(bool running) {
 }
 
 void MainWindow::on_start_clicked() {
-    if (!m_isRunning) {
-        m_startTime = std::chrono::steady_clock::now();
-        m_timeoutConnection = Glib::signal_timeout().connect(sigc::mem_fun(*this, &MainWindow::on_timeout), 1000);
-        m_isRunning = true;
-
+    if (!main_timer().running) {
+        start_timer(kMainTimerId);
         update_running_state(true);
     }
 }
 
 void MainWindow::on_stop_clicked() {
-    if (m_isRunning) {
-        m_timeoutConnection.disconnect();
-        auto now = std::chrono::steady_clock::now();
-        m_accumulatedTime += std::chrono::duration_cast<std::chrono::seconds>(now - m_startTime);
-        m_isRunning = false;
-
+    if (main_timer().running) {
+        pause_timer(kMainTimerId);
         update_running_state(false);
     }
 }
 
 void MainWindow::on_save_clicked() {
     // Stop if running
-    if (m_isRunning) {
+    if (main_timer().running) {
         on_stop_clicked();
     }
 
-    // Get data
-    std::string name = m_nameEntry.get_text();
-    std::string desc = m_descEntry.get_text();
-    
-    // Calculate total minutes
-    double minutes = static_cast<double>(m_accumulatedTime.count()) / 60.0;
+    log_session(m_nameEntry.get_text(), m_descEntry.get_text(), main_timer().accumulated);
+
+    // Reset
+    main_timer().accumulated = std::chrono::seconds{0};
+    m_timerLabel.set_text("00:00:00");
+    m_nameEntry.set_text("");
+    m_descEntry.set_text("");
+    update_running_state(false);
+    show_saved_status();
+}
 
+void MainWindow::show_saved_status() {
+    auto statusCtx = m_statusLabel.get_style_context();
+    statusCtx->remove_class("paused");
+    statusCtx->remove_class("running");
+    statusCtx->add_class("saved");
+    m_statusLabel.set_text("Session saved!");
+    m_spinner.stop();
+}
+
+void MainWindow::log_session(const std::string& name, const std::string& desc, std::chrono::seconds duration) {
     WorkSession ws;
     ws.name = name;
     ws.description = desc;
-    ws.durationMinutes = minutes;
+    ws.durationMinutes = static_cast<double>(duration.count()) / 60.0;
     auto now = std::chrono::system_clock::now();
     ws.startTime = now;
-    ws.endTime = now + std::chrono::duration_cast<std::chrono::milliseconds>(m_accumulatedTime);
+    ws.endTime = now + std::chrono::duration_cast<std::chrono::milliseconds>(duration);
     auto t = std::chrono::system_clock::to_time_t(now);
     {
         std::ostringstream oss;
@@ -563,35 +857,209 @@ void MainWindow::on_save_clicked() {
     m_sessions.push_back(ws);
     write_sessions_to_file();
     refresh_sessions_list();
+}
 
-    // Reset
-    m_accumulatedTime = std::chrono::seconds{0};
-    m_timerLabel.set_text("00:00:00");
-    m_nameEntry.set_text("");
-    m_descEntry.set_text("");
-    update_running_state(false);
+WorkTimer& MainWindow::main_timer() {
+    return m_timers.at(kMainTimerId);
+}
 
-    // Show saved state
-    auto statusCtx = m_statusLabel.get_style_context();
-    statusCtx->remove_class("paused");
-    statusCtx->remove_class("running");
-    statusCtx->add_class("saved");
-    m_statusLabel.set_text("Session saved!");
-    m_spinner.stop();
+void MainWindow::add_timer(bool pomodoro) {
+    int id = m_nextTimerId++;
+    WorkTimer& timer = m_timers[id];
+    timer.id = id;
+    // Extra timers have their own name entry; the session entries stay with the main timer
+    timer.name = m_timerNameEntry.get_text();
+    if (timer.name.empty()) {
+        timer.name = (pomodoro ? "Pomodoro " : "Timer ") + std::to_string(id);
+    }
+    m_timerNameEntry.set_text("");
+    if (pomodoro) {
+        timer.phase = WorkTimer::Phase::Work;
+        timer.phaseLength = kPomodoroWork;
+    }
+
+    auto row = Gtk::manage(new Gtk::Box(Gtk::ORIENTATION_HORIZONTAL));
+    row->set_spacing(8);
+    row->get_style_context()->add_class("timer-row");
+
+    auto label = Gtk::manage(new Gtk::Label());
+    label->set_xalign(0.0);
+    label->get_style_context()->add_class("timer-row-label");
+    row->pack_start(*label, Gtk::PACK_EXPAND_WIDGET);
+
+    auto toggle = Gtk::manage(new Gtk::Button("Start"));
+    toggle->signal_clicked().connect([this, id]() { on_timer_toggle_clicked(id); });
+    row->pack_start(*toggle, Gtk::PACK_SHRINK);
+
+    auto save = Gtk::manage(new Gtk::Button("Save"));
+    save->signal_clicked().connect([this, id]() { save_timer(id); });
+    row->pack_start(*save, Gtk::PACK_SHRINK);
+
+    auto remove = Gtk::manage(new Gtk::Button("Remove"));
+    remove->signal_clicked().connect([this, id]() { remove_timer(id); });
+    row->pack_start(*remove, Gtk::PACK_SHRINK);
+
+    timer.label = label;
+    timer.toggleButton = toggle;
+    timer.row = row;
+
+    m_timersBox.pack_start(*row, Gtk::PACK_SHRINK);
+    row->show_all();
+
+    start_timer(id);
 }
 
-bool MainWindow::on_timeout() {
+void MainWindow::remove_timer(int id) {
+    auto it = m_timers.find(id);
+    if (id == kMainTimerId || it == m_timers.end()) return;
+
+    pause_timer(id);
+    Gtk::Widget* row = it->second.row;
+    m_timers.erase(it);
+    if (row) {
+        // Called from one of the row's own buttons; drop the row once the click has finished
+        Glib::signal_idle().connect_once([this, row]() { m_timersBox.remove(*row); });
+    }
+}
+
+void MainWindow::start_timer(int id) {
+    auto it = m_timers.find(id);
+    if (it == m_timers.end() || it->second.running) return;
+
+    WorkTimer& timer = it->second;
+    ensure_ticking();
+    timer.startTime = std::chrono::steady_clock::now();
+    timer.running = true;
+    if (timer.phase != WorkTimer::Phase::Free) {
+        schedule_transition(timer);
+    }
+    if (timer.toggleButton) timer.toggleButton->set_label("Pause");
+    if (timer.row) timer.row->get_style_context()->add_class("running");
+    refresh_timer_labels(timer.startTime);
+}
+
+void MainWindow::pause_timer(int id) {
+    auto it = m_timers.find(id);
+    if (it == m_timers.end() || !it->second.running) return;
+
+    WorkTimer& timer = it->second;
     auto now = std::chrono::steady_clock::now();
-    auto currentDuration = m_accumulatedTime + std::chrono::duration_cast<std::chrono::seconds>(now - m_startTime);
-    
-    int totalSeconds = static_cast<int>(currentDuration.count());
-    int hours = totalSeconds / 3600;
-    int minutes = (totalSeconds % 3600) / 60;
-    int seconds = totalSeconds % 60;
+    timer.accumulated = timer.elapsed(now);
+    timer.running = false;
+    if (timer.transition) {
+        m_wheel.cancel(timer.transition);
+        timer.transition = 0;
+    }
+    if (timer.toggleButton) timer.toggleButton->set_label("Start");
+    if (timer.row) timer.row->get_style_context()->remove_class("running");
+    refresh_timer_labels(now);
 
-    char buffer[16];
-    snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d", hours, minutes, seconds);
-    m_timerLabel.set_text(buffer);
+    // No wakeups while every timer is idle
+    if (!any_timer_running()) {
+        m_tickConnection.disconnect();
+    }
+}
+
+void MainWindow::save_timer(int id) {
+    auto it = m_timers.find(id);
+    if (id == kMainTimerId || it == m_timers.end()) return;
+
+    const WorkTimer& timer = it->second;
+    log_session(timer.name, timer.description, timer.loggedTime(std::chrono::steady_clock::now()));
+    remove_timer(id);
+
+    // Leave the status line alone while it is reporting a running main session
+    if (!main_timer().running) {
+        show_saved_status();
+    }
+}
+
+void MainWindow::on_timer_toggle_clicked(int id) {
+    auto it = m_timers.find(id);
+    if (it == m_timers.end()) return;
+    if (it->second.running) {
+        pause_timer(id);
+    } else {
+        start_timer(id);
+    }
+}
+
+void MainWindow::schedule_transition(WorkTimer& timer) {
+    // Wheel tick N falls due at m_wheelEpoch + N seconds; fire on the first tick at or after
+    // the countdown reaches zero so the switch never runs ahead of the label.
+    timer.phaseEnd = timer.startTime + (timer.phaseLength - timer.accumulated);
+    auto dueTick = std::chrono::ceil<std::chrono::seconds>(timer.phaseEnd - m_wheelEpoch).count();
+    auto nowTick = static_cast<long long>(m_wheel.now());
+    std::uint64_t ticks = dueTick > nowTick ? static_cast<std::uint64_t>(dueTick - nowTick) : 0;
+    int id = timer.id;
+    timer.transition = m_wheel.schedule(ticks, [this, id]() { on_phase_transition(id); });
+}
+
+void MainWindow::on_phase_transition(int id) {
+    auto it = m_timers.find(id);
+    if (it == m_timers.end()) return;
+
+    WorkTimer& timer = it->second;
+    timer.transition = 0;
+    if (timer.phase == WorkTimer::Phase::Work) {
+        timer.workTotal += timer.phaseLength;
+        timer.phase = WorkTimer::Phase::Break;
+        timer.phaseLength = kPomodoroBreak;
+    } else {
+        timer.phase = WorkTimer::Phase::Work;
+        timer.phaseLength = kPomodoroWork;
+    }
+    // The phase shows on the timer's own row; the status line belongs to the main timer
+    if (timer.row) {
+        auto rowCtx = timer.row->get_style_context();
+        if (timer.phase == WorkTimer::Phase::Break) {
+            rowCtx->add_class("break");
+        } else {
+            rowCtx->remove_class("break");
+        }
+    }
+    // Start the next phase from the scheduled expiry so wakeup latency does not accumulate
+    timer.accumulated = std::chrono::seconds{0};
+    timer.startTime = timer.phaseEnd;
+    schedule_transition(timer);
+}
+
+void MainWindow::ensure_ticking() {
+    if (m_tickConnection.connected()) return;
+
+    // Re-anchor the wheel so its tick count lines up with wall time again
+    m_wheelEpoch = std::chrono::steady_clock::now() - std::chrono::seconds(m_wheel.now());
+    m_tickConnection = Glib::signal_timeout().connect(sigc::mem_fun(*this, &MainWindow::on_timeout), 1000);
+}
+
+bool MainWindow::any_timer_running() const {
+    for (const auto& entry : m_timers) {
+        if (entry.second.running) return true;
+    }
+    return false;
+}
+
+void MainWindow::refresh_timer_labels(std::chrono::steady_clock::time_point now) {
+    for (const auto& entry : m_timers) {
+        const WorkTimer& timer = entry.second;
+        if (!timer.label) continue;
+        if (timer.id == kMainTimerId) {
+            timer.label->set_text(format_duration(timer.elapsed(now)));
+        } else {
+            timer.label->set_text(format_timer_text(timer, now));
+        }
+    }
+}
+
+bool MainWindow::on_timeout() {
+    // Single wakeup for all timers: catch the wheel up to wall time, then redraw every label once
+    auto now = std::chrono::steady_clock::now();
+    auto due = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::seconds>(now - m_wheelEpoch).count());
+    if (due > m_wheel.now()) {
+        m_wheel.advance(due - m_wheel.now());
+    }
+    refresh_timer_labels(now);
 
-    return true; // Keep calling
+    return any_timer_running(); // Keep calling while anything runs
 }
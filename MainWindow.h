@@ -3,8 +3,11 @@
 
 #include <gtkmm.h>
 #include "WorkSession.h"
+#include "WorkTimer.h"
+#include "TimerWheel.h"
 #include <vector>
 #include <string>
+#include <map>
 
 class MainWindow : public Gtk::Window {
 public:
@@ -29,18 +32,27 @@ protected:
     Gtk::Button m_stopButton;
     Gtk::Button m_saveButton;
     Gtk::Button m_resetButton;
-    Gtk::Button m_deleteButton;
+
+    // Additional timers
+    Gtk::Box m_timerButtonBox;
+    Gtk::Entry m_timerNameEntry;
+    Gtk::Button m_addTimerButton;
+    Gtk::Button m_addPomodoroButton;
+    Gtk::Box m_timersBox;
 
     // Sessions panel
     Gtk::Frame m_sessionsFrame;
     Gtk::Box m_sessionsBox;
     Gtk::ScrolledWindow m_sessionsScroll;
     Gtk::ListBox m_sessionsList;
-    Gtk::Box m_editBox;
-    Gtk::Entry m_editName;
-    Gtk::Entry m_editDesc;
-    Gtk::Label m_editDuration;
-    Gtk::Button m_updateButton;
+    // Edit panel, built on first row selection (see create_edit_panel)
+    Gtk::Box* m_editBox;
+    Gtk::Entry* m_editName;
+    Gtk::Entry* m_editDesc;
+    Gtk::Label* m_editDuration;
+    Gtk::Button* m_updateButton;
+    Gtk::Button* m_deleteButton;
+    Gtk::Button m_archiveButton;
 
     // Helpers
     void setup_css();
@@ -49,14 +61,38 @@ protected:
     Glib::RefPtr<Gdk::Pixbuf> load_scaled_pixbuf(const std::string& path, int target_width);
     void update_running_state(bool running);
     void setup_sessions_panel();
+    void create_edit_panel();
+    void hide_edit_panel();
     void refresh_sessions_list();
-    void load_sessions_from_file();
+    void load_sessions_from_file(bool includeArchives = false);
     void write_sessions_to_file();
+    bool write_archive_segment(const std::string& path);
+    void archive_old_sessions();
+    std::vector<std::string> list_archive_segments() const;
+    void on_archive_clicked();
+    void on_startup_idle();
+    void reload_after_archive_error(const std::string& message);
     std::string find_asset_path(const std::string& filename) const;
     void on_session_row_selected(Gtk::ListBoxRow* row);
     void on_update_session_clicked();
     void on_delete_session_clicked();
     void on_reset_clicked();
+    void show_saved_status();
+    void log_session(const std::string& name, const std::string& desc, std::chrono::seconds duration);
+
+    // Timers
+    WorkTimer& main_timer();
+    void add_timer(bool pomodoro);
+    void remove_timer(int id);
+    void start_timer(int id);
+    void pause_timer(int id);
+    void save_timer(int id);
+    void on_timer_toggle_clicked(int id);
+    void schedule_transition(WorkTimer& timer);
+    void on_phase_transition(int id);
+    void ensure_ticking();
+    bool any_timer_running() const;
+    void refresh_timer_labels(std::chrono::steady_clock::time_point now);
 
     // Signal handlers
     void on_start_clicked();
@@ -64,13 +100,15 @@ protected:
     void on_save_clicked();
     bool on_timeout();
 
-    // Timer state
-    bool m_isRunning;
-    std::chrono::steady_clock::time_point m_startTime;
-    std::chrono::seconds m_accumulatedTime;
-    sigc::connection m_timeoutConnection;
+    // Timer state: every timer shares one wheel and one GLib timeout
+    std::map<int, WorkTimer> m_timers;   // id 0 is the main timer
+    int m_nextTimerId;
+    TimerWheel m_wheel;
+    std::chrono::steady_clock::time_point m_wheelEpoch;
+    sigc::connection m_tickConnection;
     std::vector<Gtk::Image*> m_characterImages;
     std::vector<WorkSession> m_sessions;
+    bool m_archivesLoaded;
 };
 
 #endif // MAINWINDOW_H
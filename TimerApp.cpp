@@ -1,5 +1,42 @@
 #include <gtkmm.h>
 #include "MainWindow.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#ifdef __linux__
+#include <ctime>
+#include <unistd.h>
+#endif
+
+namespace {
+// Fallback origin when the exec time is unavailable: static init, after dynamic linking.
+const auto kProcessStart = std::chrono::steady_clock::now();
+
+// Milliseconds since exec, or a negative value if the platform cannot tell.
+double ms_since_exec() {
+#ifdef __linux__
+    std::ifstream statFile("/proc/self/stat");
+    std::string stat;
+    std::getline(statFile, stat);
+    auto commEnd = stat.rfind(')');
+    if (commEnd != std::string::npos) {
+        // Field 22 (starttime, in clock ticks since boot); fields after comm start at 3
+        std::istringstream fields(stat.substr(commEnd + 1));
+        std::string field;
+        for (int i = 3; i < 22 && fields >> field; ++i) {}
+        unsigned long long startTicks = 0;
+        timespec now {};
+        if (fields >> startTicks && clock_gettime(CLOCK_BOOTTIME, &now) == 0) {
+            double nowMs = now.tv_sec * 1000.0 + now.tv_nsec / 1e6;
+            return nowMs - startTicks * 1000.0 / sysconf(_SC_CLK_TCK);
+        }
+    }
+#endif
+    return -1.0;
+}
+}
 
 int main(int argc, char* argv[])
 {
@@ -9,7 +46,20 @@ int main(int argc, char* argv[])
     // 2. Create the Main Window
     MainWindow window;
 
+    // Set NODISTRACTIONS_STARTUP_TIMING to report time-to-first-frame on stderr
+    if (!Glib::getenv("NODISTRACTIONS_STARTUP_TIMING").empty()) {
+        auto firstFrame = std::make_shared<sigc::connection>();
+        *firstFrame = window.signal_draw().connect([firstFrame](const Cairo::RefPtr<Cairo::Context>&) {
+            firstFrame->disconnect();
+            std::chrono::duration<double, std::milli> sinceInit = std::chrono::steady_clock::now() - kProcessStart;
+            double sinceExec = ms_since_exec();
+            std::cerr << "Startup: first frame after ";
+            if (sinceExec >= 0.0) std::cerr << sinceExec << " ms from exec, ";
+            std::cerr << sinceInit.count() << " ms from static init" << std::endl;
+            return false;
+        }, false);
+    }
+
     // 3. Run the application
     return app->run(window);
 }
-
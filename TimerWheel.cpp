@@ -0,0 +1,89 @@
+#include "TimerWheel.h"
+#include <algorithm>
+#include <utility>
+
+TimerWheel::TimerWheel()
+    : m_now(0),
+    m_nextId(1) {}
+
+TimerWheel::TimerId TimerWheel::schedule(std::uint64_t delayTicks, Callback cb) {
+    if (delayTicks == 0) delayTicks = 1;
+    TimerId id = m_nextId++;
+    insert(Entry{id, m_now + delayTicks, std::move(cb)});
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    auto it = m_locations.find(id);
+    if (it == m_locations.end()) return false;
+
+    // The entry may already have been moved out of its slot by tick(); dropping
+    // the location is enough for tick() to skip it.
+    auto& slot = m_slots[it->second.level][it->second.slot];
+    slot.erase(std::remove_if(slot.begin(), slot.end(),
+                              [id](const Entry& e) { return e.id == id; }),
+               slot.end());
+    m_locations.erase(it);
+    return true;
+}
+
+void TimerWheel::advance(std::uint64_t ticks) {
+    for (std::uint64_t i = 0; i < ticks; ++i) {
+        tick();
+    }
+}
+
+void TimerWheel::insert(Entry entry) {
+    std::uint64_t delta = entry.expiry > m_now ? entry.expiry - m_now : 0;
+
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (std::uint64_t{1} << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+
+    // Anything beyond the top level's span parks in the slot furthest from now
+    // and is re-placed when that slot cascades.
+    std::uint64_t placeAt = entry.expiry < m_now ? m_now : entry.expiry;
+    const std::uint64_t span = std::uint64_t{1} << (kSlotBits * kLevels);
+    if (delta >= span) {
+        placeAt = m_now + span - 1;
+    }
+
+    int slot = static_cast<int>((placeAt >> (kSlotBits * level)) & (kSlots - 1));
+    m_locations[entry.id] = Location{level, slot};
+    m_slots[level][slot].push_back(std::move(entry));
+}
+
+void TimerWheel::cascade(int level) {
+    int slot = static_cast<int>((m_now >> (kSlotBits * level)) & (kSlots - 1));
+    std::vector<Entry> entries;
+    entries.swap(m_slots[level][slot]);
+    for (auto& e : entries) {
+        insert(std::move(e));
+    }
+}
+
+void TimerWheel::tick() {
+    ++m_now;
+
+    // Cascade from the top down so an entry can fall through several levels in one tick.
+    for (int level = kLevels - 1; level > 0; --level) {
+        const std::uint64_t lowerMask = (std::uint64_t{1} << (kSlotBits * level)) - 1;
+        if ((m_now & lowerMask) == 0) {
+            cascade(level);
+        }
+    }
+
+    std::vector<Entry> due;
+    due.swap(m_slots[0][m_now & (kSlots - 1)]);
+    for (auto& e : due) {
+        // Skip entries cancelled by an earlier callback in this batch.
+        if (m_locations.find(e.id) == m_locations.end()) continue;
+        if (e.expiry > m_now) {
+            insert(std::move(e));
+            continue;
+        }
+        m_locations.erase(e.id);
+        if (e.cb) e.cb();
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// Hierarchical timer wheel driven by an external tick source.
+// Level 0 has one slot per tick; each higher level covers 64x the span of the
+// one below and is cascaded down as the lower level wraps. Scheduling and
+// cancelling are O(1) on average, and advancing touches only the due slots.
+class TimerWheel {
+public:
+    using TimerId = std::uint64_t;
+    using Callback = std::function<void()>;
+
+    TimerWheel();
+
+    // Schedule cb to run after delayTicks ticks (a delay of 0 fires on the next tick).
+    TimerId schedule(std::uint64_t delayTicks, Callback cb);
+    // Returns false if the timer already fired or was never scheduled.
+    bool cancel(TimerId id);
+    // Move the wheel forward, firing every callback that falls due on the way.
+    void advance(std::uint64_t ticks);
+
+    std::uint64_t now() const { return m_now; }
+    bool empty() const { return m_locations.empty(); }
+
+private:
+    static const int kSlotBits = 6;
+    static const int kSlots = 1 << kSlotBits;
+    static const int kLevels = 4;
+
+    struct Entry {
+        TimerId id;
+        std::uint64_t expiry;
+        Callback cb;
+    };
+    struct Location {
+        int level;
+        int slot;
+    };
+
+    void insert(Entry entry);
+    void cascade(int level);
+    void tick();
+
+    std::array<std::array<std::vector<Entry>, kSlots>, kLevels> m_slots;
+    std::unordered_map<TimerId, Location> m_locations;
+    std::uint64_t m_now;
+    TimerId m_nextId;
+};
+
+#endif // TIMERWHEEL_H
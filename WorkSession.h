@@ -11,6 +11,7 @@ struct WorkSession {
     std::chrono::system_clock::time_point startTime;
     std::chrono::system_clock::time_point endTime;
     double durationMinutes {0.0};
+    std::string archivePath;   // Compressed segment holding this session; empty for the recent log
 
     // Helper to calculate duration in minutes
     double getDurationInMinutes() const {
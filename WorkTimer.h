@@ -0,0 +1,48 @@
+#ifndef WORKTIMER_H
+#define WORKTIMER_H
+
+#include <string>
+#include <chrono>
+#include "TimerWheel.h"
+
+namespace Gtk {
+class Label;
+class Button;
+class Widget;
+}
+
+struct WorkTimer {
+    enum class Phase { Free, Work, Break };
+
+    int id {0};
+    std::string name;
+    std::string description;
+    bool running {false};
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::seconds accumulated {0};   // Time in the current phase (whole run for free timers)
+
+    // Pomodoro timers alternate Work/Break; transitions are scheduled on the timer wheel.
+    Phase phase {Phase::Free};
+    std::chrono::seconds phaseLength {0};
+    std::chrono::seconds workTotal {0};     // Completed work phases
+    TimerWheel::TimerId transition {0};
+    std::chrono::steady_clock::time_point phaseEnd;   // When the scheduled transition is due
+
+    // Widgets showing this timer (owned by the window)
+    Gtk::Label* label {nullptr};
+    Gtk::Button* toggleButton {nullptr};
+    Gtk::Widget* row {nullptr};
+
+    std::chrono::seconds elapsed(std::chrono::steady_clock::time_point now) const {
+        if (!running) return accumulated;
+        return accumulated + std::chrono::duration_cast<std::chrono::seconds>(now - startTime);
+    }
+
+    // Time worth logging when the timer is saved
+    std::chrono::seconds loggedTime(std::chrono::steady_clock::time_point now) const {
+        if (phase == Phase::Free) return elapsed(now);
+        return workTotal + (phase == Phase::Work ? elapsed(now) : std::chrono::seconds{0});
+    }
+};
+
+#endif // WORKTIMER_H